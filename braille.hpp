@@ -0,0 +1,291 @@
+#pragma once
+
+#include "sorty.hpp"
+#include <string>
+#include <vector>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#define SAL_POSIX_TERMINAL
+#endif
+
+namespace sal{
+
+    struct BrailleCell{
+        uint32_t glyph = 0;
+        sf::Color color = sf::Color::White;
+
+        bool operator==(const BrailleCell& other) const{
+            return glyph == other.glyph && color == other.color;
+        }
+
+        bool operator!=(const BrailleCell& other) const{
+            return !(*this == other);
+        }
+    };
+
+    // Text grid where the bar area is drawn with braille cells, 2x4 dots per character.
+    // display() only writes the cells that changed since the previous frame.
+    class braille_screen {
+    public:
+        const sf::Color normal_color = sf::Color::White;
+
+        braille_screen(uint32_t cols, uint32_t rows): text_rows(0) {
+            resize(cols, rows);
+        }
+
+        void resize(uint32_t new_cols, uint32_t new_rows){
+            cols = std::max<uint32_t>(new_cols, 1);
+            rows = std::max(new_rows, text_rows + 1);
+            back.assign(cols * rows, BrailleCell());
+            heights.assign(dot_width(), 0);
+            colors.assign(dot_width(), normal_color);
+            invalidate();
+        }
+
+        uint32_t get_cols() const{ return cols; }
+        uint32_t get_rows() const{ return rows; }
+
+        uint32_t dot_width() const{ return cols * 2; }
+        uint32_t dot_height() const{ return (rows - text_rows) * 4; }
+
+        sf::FloatRect render_area() const{
+            return sf::FloatRect(0, 0, dot_width(), dot_height());
+        }
+
+        void invalidate(){
+            front.assign(cols * rows, BrailleCell());
+            redraw = true;
+        }
+
+        void clear(){
+            std::fill(heights.begin(), heights.end(), 0);
+            std::fill(colors.begin(), colors.end(), normal_color);
+        }
+
+        // Several bars may fall in the same dot column: keep the tallest, highlights stick.
+        void plot_bar(uint32_t x, float h, const sf::Color& color){
+            if (x >= dot_width())
+                return;
+            uint32_t dots = std::min(static_cast<uint32_t>(std::max(h, 0.f) + 0.5f), dot_height());
+            heights[x] = std::max(heights[x], dots);
+            if (color != normal_color)
+                colors[x] = color;
+        }
+
+        // Writes text over the top rows, as many as it has lines; the bar area shrinks to fit.
+        void print(const std::string& text){
+            uint32_t lines_count = std::count(text.begin(), text.end(), '\n') + 1;
+            if (lines_count != text_rows){
+                text_rows = lines_count;
+                resize(cols, rows);
+            }
+            std::istringstream lines(text);
+            std::string line;
+            for (uint32_t r = 0; r < text_rows; ++r){
+                if (!std::getline(lines, line))
+                    line.clear();
+                for (uint32_t c = 0; c < cols; ++c){
+                    BrailleCell& cell = back[r * cols + c];
+                    cell.glyph = (c < line.size()) ? static_cast<unsigned char>(line[c]) : ' ';
+                    cell.color = normal_color;
+                }
+            }
+        }
+
+        void display(std::ostream& os){
+            compose();
+
+            std::string out;
+            if (redraw){
+                out += "\x1b[0m\x1b[2J\x1b[?25l";
+                redraw = false;
+            }
+
+            bool in_place = false;
+            bool has_color = false;
+            sf::Color current;
+            for (uint32_t r = 0; r < rows; ++r){
+                in_place = false;
+                for (uint32_t c = 0; c < cols; ++c){
+                    const BrailleCell& cell = back[r * cols + c];
+                    if (cell == front[r * cols + c]){
+                        in_place = false;
+                        continue;
+                    }
+                    if (!in_place){
+                        out += "\x1b[" + std::to_string(r + 1) + ";" + std::to_string(c + 1) + "H";
+                        in_place = true;
+                    }
+                    if (!has_color || cell.color != current){
+                        out += "\x1b[38;2;" + std::to_string(cell.color.r) + ";" + std::to_string(cell.color.g)
+                             + ";" + std::to_string(cell.color.b) + "m";
+                        current = cell.color;
+                        has_color = true;
+                    }
+                    append_utf8(out, cell.glyph);
+                    front[r * cols + c] = cell;
+                }
+            }
+            os << out << std::flush;
+        }
+
+        void restore(std::ostream& os){
+            os << "\x1b[0m\x1b[" << rows << ";1H\n\x1b[?25h" << std::flush;
+        }
+
+    private:
+        uint32_t cols, rows, text_rows;
+        bool redraw;
+        std::vector<BrailleCell> front, back;
+        std::vector<uint32_t> heights;
+        std::vector<sf::Color> colors;
+
+        // Dot bit of column x (0..1), row y (0..3) inside a braille cell (U+2800 block).
+        static uint32_t dot_bit(uint32_t x, uint32_t y){
+            static const uint32_t bits[2][4] = {{0x01, 0x02, 0x04, 0x40},
+                                                {0x08, 0x10, 0x20, 0x80}};
+            return bits[x][y];
+        }
+
+        void compose(){
+            uint32_t bottom = dot_height();
+            for (uint32_t r = text_rows; r < rows; ++r){
+                uint32_t top = (r - text_rows) * 4;
+                for (uint32_t c = 0; c < cols; ++c){
+                    uint32_t pattern = 0;
+                    sf::Color color = normal_color;
+                    for (uint32_t x = 0; x < 2; ++x){
+                        uint32_t column = c * 2 + x;
+                        for (uint32_t y = 0; y < 4; ++y){
+                            if (top + y >= bottom - heights[column])
+                                pattern |= dot_bit(x, y);
+                        }
+                        if (colors[column] != normal_color)
+                            color = colors[column];
+                    }
+                    BrailleCell& cell = back[r * cols + c];
+                    cell.glyph = pattern ? 0x2800 + pattern : ' ';
+                    cell.color = pattern ? color : normal_color;
+                }
+            }
+        }
+
+        static void append_utf8(std::string& out, uint32_t glyph){
+            if (glyph < 0x80){
+                out += static_cast<char>(glyph);
+            }
+            else if (glyph < 0x800){
+                out += static_cast<char>(0xC0 | (glyph >> 6));
+                out += static_cast<char>(0x80 | (glyph & 0x3F));
+            }
+            else{
+                out += static_cast<char>(0xE0 | (glyph >> 12));
+                out += static_cast<char>(0x80 | ((glyph >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (glyph & 0x3F));
+            }
+        }
+    };
+
+    void render(sorty_vector& vec, braille_screen& screen, const SortyManInfo& stats){
+        std::stringstream log_stream;
+        log_stream << stats;
+        screen.print(log_stream.str());
+
+        screen.clear();
+        for (size_t i=0; i < vec.size(); ++i){
+            vec.get(i).make_drawable(i, vec.size(), screen.render_area());
+            auto& rect = vec.get(i).get_rect();
+            screen.plot_bar(static_cast<uint32_t>(rect.getPosition().x), rect.getSize().y, rect.getFillColor());
+        }
+    }
+
+    // Raw keyboard input and window size of the controlling terminal.
+    class terminal {
+    public:
+        enum Key {None, Left, Right, Space, Shuffle, Quit};
+
+        terminal(){
+#ifdef SAL_POSIX_TERMINAL
+            if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &saved) == 0){
+                termios raw = saved;
+                raw.c_lflag &= ~(ICANON | ECHO | ISIG);
+                raw.c_cc[VMIN] = 0;
+                raw.c_cc[VTIME] = 0;
+                raw_mode = tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0;
+            }
+#endif
+        }
+
+        ~terminal(){
+#ifdef SAL_POSIX_TERMINAL
+            if (raw_mode)
+                tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+#endif
+        }
+
+        void size(uint32_t& cols, uint32_t& rows) const{
+            cols = 80;
+            rows = 24;
+#ifdef SAL_POSIX_TERMINAL
+            winsize ws;
+            if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_col > 0 && ws.ws_row > 0){
+                cols = ws.ws_col;
+                rows = ws.ws_row;
+            }
+#endif
+        }
+
+        // Waits at most timeout_ms for a key press. Without a keyboard (stdin not a tty,
+        // or at end of file) it just sleeps, so callers can still pace their frames on it.
+        Key read_key(uint32_t timeout_ms){
+#ifdef SAL_POSIX_TERMINAL
+            if (!raw_mode){
+                sf::sleep(sf::milliseconds(timeout_ms));
+                return None;
+            }
+            fd_set fds;
+            FD_ZERO(&fds);
+            FD_SET(STDIN_FILENO, &fds);
+            timeval tv{static_cast<time_t>(timeout_ms / 1000), static_cast<suseconds_t>((timeout_ms % 1000) * 1000)};
+            if (select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv) <= 0)
+                return None;
+            char c;
+            if (read(STDIN_FILENO, &c, 1) != 1){
+                sf::sleep(sf::milliseconds(timeout_ms));
+                return None;
+            }
+            switch (c){
+                case ' ': return Space;
+                case 'c': case 'C': return Shuffle;
+                case 'q': case 'Q': case 3: return Quit;
+                case 'h': return Left;
+                case 'l': return Right;
+                case '\x1b':{
+                    char seq[2];
+                    if (read(STDIN_FILENO, &seq[0], 1) == 1 && read(STDIN_FILENO, &seq[1], 1) == 1 && seq[0] == '['){
+                        if (seq[1] == 'D') return Left;
+                        if (seq[1] == 'C') return Right;
+                    }
+                    return None;
+                }
+            }
+            return None;
+#else
+            sf::sleep(sf::milliseconds(timeout_ms));
+            return None;
+#endif
+        }
+
+    private:
+#ifdef SAL_POSIX_TERMINAL
+        termios saved;
+#endif
+        bool raw_mode = false;
+    };
+
+}
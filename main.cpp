@@ -3,10 +3,14 @@
 #include <mutex>
 #include <condition_variable>
 #include <stdio.h>
+#include <random>
 
 #include "sorts.hpp"
+#include "braille.hpp"
 
-//g++ -o main main.cpp -lsfml-graphics -lsfml-window -lsfml-system
+//g++ -std=c++17 -o main main.cpp -lsfml-graphics -lsfml-window -lsfml-system
+//./main            SFML window
+//./main --terminal braille renderer for headless machines
 
 std::condition_variable cv;
 std::mutex mtx;
@@ -27,7 +31,10 @@ std::vector<std::string> algorithms = {"Shuffle Mode",
                                        "heap sort",
                                        "shell sort",
                                        "counting sort",
-                                       "radix sort"};
+                                       "radix sort",
+                                       "blocks of 32: static_sort (" + std::to_string(sal::network_size<32>()) + " comparators/block)",
+                                       "blocks of 32: insertion sort",
+                                       "blocks of 32 via static_sort + merge"};
 
 void shuffleVector(sal::sorty_vector& v) {
     while(alive){
@@ -40,7 +47,7 @@ void shuffleVector(sal::sorty_vector& v) {
         }
         switch(selector){
             case 0:
-                std::random_shuffle(v.begin(), v.end());
+                std::shuffle(v.begin(), v.end(), std::mt19937{std::random_device{}()});
                 break;
             case 1:
                 insertion_sort(v.begin(), v.end());
@@ -76,6 +83,15 @@ void shuffleVector(sal::sorty_vector& v) {
             case 11:
                 radix_sort(v.begin(), v.end());
                 break;
+            case 12:
+                network_blocks<32>(v.begin(), v.end());
+                break;
+            case 13:
+                insertion_blocks<32>(v.begin(), v.end());
+                break;
+            case 14:
+                network_sort<32>(v.begin(), v.end());
+                break;
         }
     }
 }
@@ -93,7 +109,72 @@ std::vector<sf::Int16> generateBeepSound(float duration, int sampleRate) {
     return samples;
 }
 
-int main(){
+void select_algorithm(int next){
+    selector = std::max(0, std::min(int(algorithms.size() - 1), next));
+}
+
+void launch_sort(sal::SortyManInfo& stats){
+    stats.reset();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ready = true;
+    }
+    cv.notify_one();
+}
+
+void stop_sorting(){
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ready = true;
+        alive = false;
+    }
+    cv.notify_one();
+}
+
+void run_terminal(sal::sorty_vector& vec, sal::SortyManInfo& stats){
+    sal::terminal term;
+    uint32_t cols, rows;
+    term.size(cols, rows);
+
+    sal::braille_screen screen(cols, rows);
+
+    while (alive) {
+        stats.algorithm_id = selector;
+
+        switch (term.read_key(33)) {
+            case sal::terminal::Shuffle:
+                select_algorithm(0);
+                launch_sort(stats);
+                break;
+            case sal::terminal::Space:
+                launch_sort(stats);
+                break;
+            case sal::terminal::Right:
+                select_algorithm(selector + 1);
+                break;
+            case sal::terminal::Left:
+                select_algorithm(selector - 1);
+                break;
+            case sal::terminal::Quit:
+                stop_sorting();
+                break;
+            default:
+                break;
+        }
+
+        term.size(cols, rows);
+        if (cols != screen.get_cols() || rows != screen.get_rows())
+            screen.resize(cols, rows);
+
+        sal::render(vec, screen, stats);
+
+        screen.display(std::cout);
+    }
+
+    screen.restore(std::cout);
+}
+
+void run_window(sal::sorty_vector& vec, sal::SortyManInfo& stats){
 
     const int sampleRate = 44100;
 
@@ -110,17 +191,10 @@ int main(){
     window.setFramerateLimit(30);
     sf::FloatRect render_area(0, text_area_h, w, h - text_area_h);
 
-    sal::sorty_vector vec(800);
-
-    auto stats = vec.make_group();
-
-    stats->set_beep(buffer);
+    stats.set_beep(buffer);
 
     sal::render(vec, window, render_area);
 
-    sf::Thread thread(&shuffleVector, std::ref(vec));
-    thread.launch();
-
     sf::Text stats_log;
     sf::Font minecraft;
     if (minecraft.loadFromFile("minecraft_font.ttf")){
@@ -131,47 +205,34 @@ int main(){
 
     bool changed = true;
 
-    stats->set_algorithms(algorithms);
-
     while (window.isOpen()) {
         if (selector < algorithms.size() && changed){
-            stats->algorithm_id = selector;
+            stats.algorithm_id = selector;
             changed = false;
         }
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed) {
                 window.close();
-                {
-                    std::lock_guard<std::mutex> lock(mtx);
-                    ready = true;
-                    alive = false;
-                }
-                cv.notify_one();
+                stop_sorting();
             }
             if (event.type == sf::Event::KeyPressed) {
                 if (event.key.code == sf::Keyboard::C) {
-                    selector = 0;
+                    select_algorithm(0);
                     changed = true;
                     event.key.code = sf::Keyboard::Space;
                 }
                 else if (event.key.code == sf::Keyboard::Right) {
-                    selector += 1;
+                    select_algorithm(selector + 1);
                     changed = true;
                 }
                 else if (event.key.code == sf::Keyboard::Left) {
-                    selector -= 1;
+                    select_algorithm(selector - 1);
                     changed = true;
                 }
                 if (event.key.code == sf::Keyboard::Space) {
-                    stats->reset();
-                    {
-                        std::lock_guard<std::mutex> lock(mtx);
-                        ready = true;
-                    }
-                    cv.notify_one();
+                    launch_sort(stats);
                 }
-                selector = std::max(0, std::min(int(algorithms.size() - 1), selector));
             }
         }
 
@@ -181,7 +242,7 @@ int main(){
 
         std::stringstream log_stream;
 
-        log_stream << (*stats);
+        log_stream << stats;
 
         stats_log.setString(log_stream.str());
 
@@ -189,12 +250,31 @@ int main(){
 
         window.display();
 
-        stats->manage_sounds();
+        stats.manage_sounds();
     }
 
-    stats->kill_sounds();
+    stats.kill_sounds();
+}
+
+int main(int argc, char* argv[]){
+
+    bool headless = argc > 1 && std::string(argv[1]) == "--terminal";
+
+    sal::sorty_vector vec(800);
+
+    auto stats = vec.make_group();
+
+    stats->set_algorithms(algorithms);
+
+    sf::Thread thread(&shuffleVector, std::ref(vec));
+    thread.launch();
+
+    if (headless)
+        run_terminal(vec, *stats);
+    else
+        run_window(vec, *stats);
 
     thread.terminate();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,520 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+namespace sal{
+
+    namespace network{
+
+        // Comparator (i, j) with i < j: after it runs, element i <= element j.
+        struct comparator{
+            std::size_t i;
+            std::size_t j;
+        };
+
+        // Upper bound of comparators any generated network may hold.
+        constexpr std::size_t max_inputs = 64;
+        constexpr std::size_t max_comparators = 1024;
+
+        struct builder{
+            std::array<comparator, max_comparators> list{};
+            std::size_t size = 0;
+
+            constexpr void add(std::size_t i, std::size_t j){
+                list[size++] = comparator{i, j};
+            }
+
+            // Appends another network, shifted to start at input offset.
+            constexpr void append(const builder& other, std::size_t offset){
+                for (std::size_t k = 0; k < other.size; ++k){
+                    add(other.list[k].i + offset, other.list[k].j + offset);
+                }
+            }
+        };
+
+        // Bose-Nelson: recursive split into halves and merge of the two sorted runs.
+        struct bose_nelson{
+            static constexpr void merge(builder& b, std::size_t i, std::size_t x, std::size_t j, std::size_t y){
+                if (x == 1 && y == 1){
+                    b.add(i, j);
+                }
+                else if (x == 1 && y == 2){
+                    b.add(i, j + 1);
+                    b.add(i, j);
+                }
+                else if (x == 2 && y == 1){
+                    b.add(i, j);
+                    b.add(i + 1, j);
+                }
+                else{
+                    std::size_t a = x / 2;
+                    std::size_t c = (x & 1) ? y / 2 : (y + 1) / 2;
+                    merge(b, i, a, j, c);
+                    merge(b, i + a, x - a, j + c, y - c);
+                    merge(b, i + a, x - a, j, c);
+                }
+            }
+
+            static constexpr void split(builder& b, std::size_t i, std::size_t length){
+                if (length >= 2){
+                    std::size_t a = length / 2;
+                    split(b, i, a);
+                    split(b, i + a, length - a);
+                    merge(b, i, a, i + a, length - a);
+                }
+            }
+
+            static constexpr builder build(std::size_t n){
+                builder b;
+                split(b, 0, n);
+                return b;
+            }
+        };
+
+        // Batcher: odd-even merge sort, generalized to any n (Knuth, TAOCP 5.2.2 M).
+        struct batcher{
+            // One pass of the outer loop: merges the sorted runs of length p in each block of 2p.
+            static constexpr void merge(builder& b, std::size_t n, std::size_t p){
+                for (std::size_t k = p; k >= 1; k >>= 1){
+                    for (std::size_t j = k % p; j + k < n; j += 2 * k){
+                        for (std::size_t i = 0; i < k && i + j + k < n; ++i){
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p)){
+                                b.add(i + j, i + j + k);
+                            }
+                        }
+                    }
+                }
+            }
+
+            static constexpr builder build(std::size_t n){
+                builder b;
+                for (std::size_t p = 1; p < n; p <<= 1){
+                    merge(b, n, p);
+                }
+                return b;
+            }
+        };
+
+        // Best known networks by size: optimal up to 12 inputs, then 45, 51, 56 and Green's
+        // 60 for 13 to 16. The 17 to 31 tables were pruned from the 32 input network (wires
+        // fixed to +/-inf, then untangled); 30 and 31 match the best known, 17 to 29 are 1 to
+        // 5 comparators above it. 32 and up sort [0, p) and [p, n), p the largest power of
+        // two below n, with this same policy and join them with Batcher's last merge (185
+        // comparators for 32, as good as known), unless Bose-Nelson or Batcher is smaller.
+        struct best_known{
+            static constexpr builder from(const comparator* first, std::size_t count){
+                builder b;
+                for (std::size_t k = 0; k < count; ++k){
+                    b.add(first[k].i, first[k].j);
+                }
+                return b;
+            }
+
+            static constexpr builder build(std::size_t n){
+                constexpr comparator n3[] = {{0,2},{0,1},{1,2}};
+                constexpr comparator n4[] = {{0,2},{1,3},{0,1},{2,3},{1,2}};
+                constexpr comparator n5[] = {{0,3},{1,4},{0,2},{1,3},{0,1},{2,4},{1,2},{3,4},{2,3}};
+                constexpr comparator n6[] = {{0,5},{1,3},{2,4},{1,2},{3,4},{0,3},{2,5},{0,1},{2,3},{4,5},
+                                             {1,2},{3,4}};
+                constexpr comparator n7[] = {{0,6},{2,3},{4,5},{0,2},{1,4},{3,6},{0,1},{2,5},{3,4},{1,2},
+                                             {4,6},{2,3},{4,5},{1,2},{3,4},{5,6}};
+                constexpr comparator n8[] = {{0,2},{1,3},{4,6},{5,7},{0,4},{1,5},{2,6},{3,7},{0,1},{2,3},
+                                             {4,5},{6,7},{2,4},{3,5},{1,4},{3,6},{1,2},{3,4},{5,6}};
+                constexpr comparator n9[] = {{0,3},{1,7},{2,5},{4,8},
+                                             {0,7},{2,4},{3,8},{5,6},
+                                             {0,2},{1,3},{4,5},{7,8},
+                                             {1,4},{3,6},{5,7},
+                                             {0,1},{2,4},{3,5},{6,8},
+                                             {2,3},{4,5},{6,7},
+                                             {1,2},{3,4},{5,6}};
+                constexpr comparator n10[] = {{0,8},{1,9},{2,7},{3,5},{4,6},
+                                              {0,2},{1,4},{5,8},{7,9},
+                                              {0,3},{2,4},{5,7},{6,9},
+                                              {0,1},{3,6},{8,9},
+                                              {1,5},{2,3},{4,8},{6,7},
+                                              {1,2},{3,5},{4,6},{7,8},
+                                              {2,3},{4,5},{6,7},
+                                              {3,4},{5,6}};
+                constexpr comparator n11[] = {{0,9},{1,6},{2,4},{3,7},{5,8},
+                                              {0,1},{3,5},{4,10},{6,9},{7,8},
+                                              {1,3},{2,5},{4,7},{8,10},
+                                              {0,4},{1,2},{3,7},{5,9},{6,8},
+                                              {0,1},{2,6},{4,5},{7,8},{9,10},
+                                              {2,4},{3,6},{5,7},{8,9},
+                                              {1,2},{3,4},{5,6},{7,8},
+                                              {2,3},{4,5},{6,7}};
+                constexpr comparator n12[] = {{0,8},{1,7},{2,6},{3,11},{4,10},{5,9},
+                                              {0,1},{2,5},{3,4},{6,9},{7,8},{10,11},
+                                              {0,2},{1,6},{5,10},{9,11},
+                                              {0,3},{1,2},{4,6},{5,7},{8,11},{9,10},
+                                              {1,4},{3,5},{6,8},{7,10},
+                                              {1,3},{2,5},{6,9},{8,10},
+                                              {2,3},{4,5},{6,7},{8,9},
+                                              {4,6},{5,7},
+                                              {3,4},{5,6},{7,8}};
+                constexpr comparator n13[] = {{0,12},{1,10},{2,9},{3,7},{5,11},{6,8},{1,6},{2,3},{4,11},{7,9},
+                                              {8,10},{0,4},{1,2},{3,6},{7,8},{9,10},{11,12},{4,6},{5,9},{8,11},
+                                              {10,12},{0,5},{3,8},{4,7},{6,11},{9,10},{0,1},{2,5},{6,9},{7,8},
+                                              {10,11},{1,3},{2,4},{5,6},{9,10},{1,2},{3,4},{5,7},{6,8},{2,3},
+                                              {4,5},{6,7},{8,9},{3,4},{5,6}};
+                constexpr comparator n14[] = {{0,13},{1,12},{2,6},{3,4},{5,9},{7,8},{3,11},{5,10},{0,7},{1,2},
+                                              {6,12},{8,13},{3,5},{0,1},{2,11},{4,6},{7,10},{8,9},{12,13},
+                                              {0,3},{1,5},{2,8},{9,11},{4,7},{6,10},{1,3},{5,12},{2,4},{7,9},
+                                              {6,8},{10,11},{1,2},{3,4},{6,7},{8,9},{10,13},{2,3},{4,5},
+                                              {10,12},{11,13},{4,6},{5,7},{8,10},{9,12},{3,4},{5,6},{7,8},
+                                              {9,10},{11,12},{6,7},{8,9}};
+                constexpr comparator n17[] = {{0,4},{2,3},{0,5},{2,8},{1,7},{0,6},{1,2},{5,8},{3,4},{0,1},
+                                              {2,6},{3,7},{1,2},{3,5},{7,8},{1,3},{2,5},{4,7},{2,3},{5,6},
+                                              {4,5},{6,7},{3,4},{5,6},{7,8},{6,7},{9,11},{10,12},{13,15},
+                                              {14,16},{9,13},{10,14},{11,15},{12,16},{9,10},{11,12},{13,14},
+                                              {15,16},{11,13},{12,14},{10,13},{12,15},{10,11},{12,13},{14,15},
+                                              {0,9},{1,10},{2,11},{3,12},{4,13},{5,14},{6,15},{7,16},{8,9},
+                                              {4,8},{5,10},{6,11},{7,12},{9,13},{2,4},{3,5},{6,8},{7,10},
+                                              {9,11},{12,14},{13,15},{1,2},{3,4},{5,6},{7,8},{9,10},{11,12},
+                                              {13,14},{15,16}};
+                constexpr comparator n18[] = {{0,4},{2,3},{0,5},{2,8},{1,7},{0,6},{1,2},{5,8},{3,4},{0,1},
+                                              {2,6},{3,7},{1,2},{3,5},{7,8},{1,3},{2,5},{4,7},{2,3},{5,6},
+                                              {4,5},{6,7},{3,4},{5,6},{7,8},{6,7},{9,17},{11,16},{12,14},
+                                              {13,15},{9,11},{10,13},{14,17},{9,12},{11,13},{14,16},{9,10},
+                                              {12,15},{10,14},{11,12},{13,17},{15,16},{10,11},{12,14},{13,15},
+                                              {16,17},{11,12},{13,14},{15,16},{12,13},{14,15},{0,9},{1,10},
+                                              {2,11},{3,12},{4,13},{5,14},{6,15},{7,16},{8,17},{8,9},{4,8},
+                                              {5,10},{6,11},{7,12},{9,13},{2,4},{3,5},{6,8},{7,10},{9,11},
+                                              {12,14},{13,15},{1,2},{3,4},{5,6},{7,8},{9,10},{11,12},{13,14},
+                                              {15,16}};
+                constexpr comparator n19[] = {{0,4},{2,3},{0,5},{2,8},{1,7},{0,6},{1,2},{5,8},{3,4},{0,1},
+                                              {2,6},{3,7},{1,2},{3,5},{7,8},{1,3},{2,5},{4,7},{2,3},{5,6},
+                                              {4,5},{6,7},{3,4},{5,6},{7,8},{6,7},{9,17},{10,18},{11,16},
+                                              {12,14},{13,15},{9,11},{10,13},{14,17},{16,18},{9,12},{11,13},
+                                              {14,16},{15,18},{9,10},{12,15},{17,18},{10,14},{11,12},{13,17},
+                                              {15,16},{10,11},{12,14},{13,15},{16,17},{11,12},{13,14},{15,16},
+                                              {12,13},{14,15},{0,9},{1,10},{2,11},{3,12},{4,13},{5,14},{6,15},
+                                              {7,16},{8,17},{8,9},{10,18},{4,8},{5,10},{6,11},{7,12},{9,13},
+                                              {14,18},{2,4},{3,5},{6,8},{7,10},{9,11},{12,14},{13,15},{16,18},
+                                              {1,2},{3,4},{5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18}};
+                constexpr comparator n20[] = {{1,5},{3,4},{0,7},{1,6},{3,9},{2,8},{0,1},{2,3},{7,8},{6,9},
+                                              {4,5},{0,2},{1,3},{4,7},{5,8},{1,2},{4,6},{7,9},{1,4},{2,6},
+                                              {5,7},{2,4},{3,6},{3,5},{6,7},{8,9},{3,4},{5,6},{7,8},{6,7},
+                                              {8,9},{10,18},{11,19},{12,17},{13,15},{14,16},{10,12},{11,14},
+                                              {15,18},{17,19},{10,13},{12,14},{15,17},{16,19},{10,11},{13,16},
+                                              {18,19},{11,15},{12,13},{14,18},{16,17},{11,12},{13,15},{14,16},
+                                              {17,18},{12,13},{14,15},{16,17},{13,14},{15,16},{0,10},{1,11},
+                                              {2,12},{3,13},{4,14},{5,15},{6,16},{7,17},{8,18},{9,19},{8,10},
+                                              {9,11},{4,8},{5,9},{6,12},{7,13},{10,14},{11,15},{2,4},{3,5},
+                                              {6,8},{7,9},{10,12},{11,13},{14,16},{15,17},{1,2},{3,4},{5,6},
+                                              {7,8},{9,10},{11,12},{13,14},{15,16},{17,18}};
+                constexpr comparator n21[] = {{0,1},{2,6},{4,5},{0,8},{2,7},{4,10},{3,9},{0,2},{3,4},{8,9},
+                                              {7,10},{5,6},{0,3},{2,4},{5,8},{6,9},{1,7},{2,3},{1,5},{6,7},
+                                              {8,10},{1,2},{3,5},{6,8},{7,10},{2,3},{4,5},{4,6},{5,8},{7,9},
+                                              {3,4},{5,6},{7,8},{9,10},{6,7},{8,9},{11,19},{12,20},{13,18},
+                                              {14,16},{15,17},{11,13},{12,15},{16,19},{18,20},{11,14},{13,15},
+                                              {16,18},{17,20},{11,12},{14,17},{19,20},{12,16},{13,14},{15,19},
+                                              {17,18},{12,13},{14,16},{15,17},{18,19},{13,14},{15,16},{17,18},
+                                              {14,15},{16,17},{0,11},{1,12},{2,13},{3,14},{4,15},{5,16},{6,17},
+                                              {7,18},{8,19},{9,20},{8,11},{9,12},{10,13},{4,8},{5,9},{6,10},
+                                              {7,14},{11,15},{12,16},{13,17},{2,4},{3,5},{6,8},{7,9},{10,11},
+                                              {12,14},{13,15},{16,18},{17,19},{1,2},{3,4},{5,6},{7,8},{9,10},
+                                              {11,12},{13,14},{15,16},{17,18},{19,20}};
+                constexpr comparator n22[] = {{0,1},{2,6},{4,5},{0,8},{2,7},{4,10},{3,9},{0,2},{3,4},{8,9},
+                                              {7,10},{5,6},{0,3},{2,4},{5,8},{6,9},{1,7},{2,3},{1,5},{6,7},
+                                              {8,10},{1,2},{3,5},{6,8},{7,10},{2,3},{4,5},{4,6},{5,8},{7,9},
+                                              {3,4},{5,6},{7,8},{9,10},{6,7},{8,9},{11,19},{12,18},{13,17},
+                                              {15,21},{16,20},{11,12},{13,16},{14,15},{17,20},{18,19},{11,13},
+                                              {12,17},{16,21},{11,14},{12,13},{15,17},{16,18},{20,21},{12,15},
+                                              {14,16},{17,19},{18,21},{12,14},{13,16},{17,20},{19,21},{13,14},
+                                              {15,16},{17,18},{19,20},{15,17},{16,18},{14,15},{16,17},{18,19},
+                                              {0,11},{1,12},{2,13},{3,14},{4,15},{5,16},{6,17},{7,18},{8,19},
+                                              {9,20},{10,21},{8,11},{9,12},{10,13},{4,8},{5,9},{6,10},{7,14},
+                                              {11,15},{12,16},{13,17},{2,4},{3,5},{6,8},{7,9},{10,11},{12,14},
+                                              {13,15},{16,18},{17,19},{1,2},{3,4},{5,6},{7,8},{9,10},{11,12},
+                                              {13,14},{15,16},{17,18},{19,20}};
+                constexpr comparator n23[] = {{0,1},{2,6},{4,5},{0,8},{2,7},{4,10},{3,9},{0,2},{3,4},{8,9},
+                                              {7,10},{5,6},{0,3},{2,4},{5,8},{6,9},{1,7},{2,3},{1,5},{6,7},
+                                              {8,10},{1,2},{3,5},{6,8},{7,10},{2,3},{4,5},{4,6},{5,8},{7,9},
+                                              {3,4},{5,6},{7,8},{9,10},{6,7},{8,9},{11,19},{12,18},{13,17},
+                                              {14,22},{15,21},{16,20},{11,12},{13,16},{14,15},{17,20},{18,19},
+                                              {21,22},{11,13},{12,17},{16,21},{20,22},{11,14},{12,13},{15,17},
+                                              {16,18},{19,22},{20,21},{12,15},{14,16},{17,19},{18,21},{12,14},
+                                              {13,16},{17,20},{19,21},{13,14},{15,16},{17,18},{19,20},{15,17},
+                                              {16,18},{14,15},{16,17},{18,19},{0,11},{1,12},{2,13},{3,14},
+                                              {4,15},{5,16},{6,17},{7,18},{8,19},{9,20},{10,21},{8,11},{9,12},
+                                              {10,13},{14,22},{4,8},{5,9},{6,10},{7,14},{11,15},{12,16},
+                                              {13,17},{18,22},{2,4},{3,5},{6,8},{7,9},{10,11},{12,14},{13,15},
+                                              {16,18},{17,19},{20,22},{1,2},{3,4},{5,6},{7,8},{9,10},{11,12},
+                                              {13,14},{15,16},{17,18},{19,20},{21,22}};
+                constexpr comparator n24[] = {{0,4},{1,2},{3,7},{5,6},{1,9},{3,8},{5,11},{0,10},{1,3},{0,5},
+                                              {9,10},{2,4},{8,11},{6,7},{0,1},{3,5},{6,9},{7,10},{2,8},{4,11},
+                                              {1,3},{2,6},{7,8},{4,9},{10,11},{1,2},{3,6},{4,7},{8,9},{2,3},
+                                              {5,6},{4,5},{6,7},{8,10},{3,4},{5,6},{7,8},{9,10},{6,7},{8,9},
+                                              {12,20},{13,19},{14,18},{15,23},{16,22},{17,21},{12,13},{14,17},
+                                              {15,16},{18,21},{19,20},{22,23},{12,14},{13,18},{17,22},{21,23},
+                                              {12,15},{13,14},{16,18},{17,19},{20,23},{21,22},{13,16},{15,17},
+                                              {18,20},{19,22},{13,15},{14,17},{18,21},{20,22},{14,15},{16,17},
+                                              {18,19},{20,21},{16,18},{17,19},{15,16},{17,18},{19,20},{0,12},
+                                              {1,13},{2,14},{3,15},{4,16},{5,17},{6,18},{7,19},{8,20},{9,21},
+                                              {10,22},{11,23},{8,12},{9,13},{10,14},{11,15},{4,8},{5,9},{6,10},
+                                              {7,11},{12,16},{13,17},{14,18},{15,19},{2,4},{3,5},{6,8},{7,9},
+                                              {10,12},{11,13},{14,16},{15,17},{18,20},{19,21},{1,2},{3,4},
+                                              {5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18},{19,20},
+                                              {21,22}};
+                constexpr comparator n25[] = {{0,13},{1,12},{2,15},{3,14},{4,8},{5,6},{7,11},{9,10},{0,5},
+                                              {1,7},{2,9},{3,4},{6,13},{8,14},{10,15},{11,12},{0,1},{2,3},
+                                              {4,5},{6,8},{7,9},{10,11},{12,13},{14,15},{0,2},{1,3},{4,10},
+                                              {5,11},{6,7},{8,9},{12,14},{13,15},{1,2},{3,12},{4,6},{5,7},
+                                              {8,10},{9,11},{13,14},{1,4},{2,6},{5,8},{7,10},{9,13},{11,14},
+                                              {2,4},{3,6},{9,12},{11,13},{3,5},{6,8},{7,9},{10,12},{3,4},{5,6},
+                                              {7,8},{9,10},{11,12},{6,7},{8,9},{16,24},{18,23},{19,21},{20,22},
+                                              {16,18},{17,20},{21,24},{16,19},{18,20},{21,23},{16,17},{19,22},
+                                              {17,21},{18,19},{20,24},{22,23},{17,18},{19,21},{20,22},{23,24},
+                                              {18,19},{20,21},{22,23},{19,20},{21,22},{0,16},{1,17},{2,18},
+                                              {3,19},{4,20},{5,21},{6,22},{7,23},{8,24},{8,16},{9,17},{10,18},
+                                              {11,19},{12,20},{13,21},{14,22},{15,23},{4,8},{5,9},{6,10},
+                                              {7,11},{12,16},{13,17},{14,18},{15,19},{20,24},{2,4},{3,5},{6,8},
+                                              {7,9},{10,12},{11,13},{14,16},{15,17},{18,20},{19,21},{22,24},
+                                              {1,2},{3,4},{5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18},
+                                              {19,20},{21,22},{23,24}};
+                constexpr comparator n26[] = {{0,13},{1,12},{2,15},{3,14},{4,8},{5,6},{7,11},{9,10},{0,5},
+                                              {1,7},{2,9},{3,4},{6,13},{8,14},{10,15},{11,12},{0,1},{2,3},
+                                              {4,5},{6,8},{7,9},{10,11},{12,13},{14,15},{0,2},{1,3},{4,10},
+                                              {5,11},{6,7},{8,9},{12,14},{13,15},{1,2},{3,12},{4,6},{5,7},
+                                              {8,10},{9,11},{13,14},{1,4},{2,6},{5,8},{7,10},{9,13},{11,14},
+                                              {2,4},{3,6},{9,12},{11,13},{3,5},{6,8},{7,9},{10,12},{3,4},{5,6},
+                                              {7,8},{9,10},{11,12},{6,7},{8,9},{16,24},{17,25},{18,23},{19,21},
+                                              {20,22},{16,18},{17,20},{21,24},{23,25},{16,19},{18,20},{21,23},
+                                              {22,25},{16,17},{19,22},{24,25},{17,21},{18,19},{20,24},{22,23},
+                                              {17,18},{19,21},{20,22},{23,24},{18,19},{20,21},{22,23},{19,20},
+                                              {21,22},{0,16},{1,17},{2,18},{3,19},{4,20},{5,21},{6,22},{7,23},
+                                              {8,24},{9,25},{8,16},{9,17},{10,18},{11,19},{12,20},{13,21},
+                                              {14,22},{15,23},{4,8},{5,9},{6,10},{7,11},{12,16},{13,17},
+                                              {14,18},{15,19},{20,24},{21,25},{2,4},{3,5},{6,8},{7,9},{10,12},
+                                              {11,13},{14,16},{15,17},{18,20},{19,21},{22,24},{23,25},{1,2},
+                                              {3,4},{5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18},{19,20},
+                                              {21,22},{23,24}};
+                constexpr comparator n27[] = {{0,11},{1,14},{2,13},{3,7},{4,5},{6,10},{8,9},{4,12},{0,6},{1,8},
+                                              {2,3},{7,13},{9,14},{10,11},{0,4},{1,2},{3,12},{5,7},{6,8},
+                                              {9,10},{13,14},{0,1},{2,4},{3,9},{10,12},{5,6},{7,8},{11,13},
+                                              {1,2},{4,11},{3,5},{6,10},{7,9},{8,12},{13,14},{1,3},{2,5},{6,7},
+                                              {9,10},{8,13},{12,14},{2,3},{4,5},{8,11},{12,13},{4,6},{5,7},
+                                              {8,9},{10,11},{3,4},{5,6},{7,8},{9,10},{11,12},{6,7},{8,9},
+                                              {15,23},{16,22},{17,21},{18,26},{19,25},{20,24},{15,16},{17,20},
+                                              {18,19},{21,24},{22,23},{25,26},{15,17},{16,21},{20,25},{24,26},
+                                              {15,18},{16,17},{19,21},{20,22},{23,26},{24,25},{16,19},{18,20},
+                                              {21,23},{22,25},{16,18},{17,20},{21,24},{23,25},{17,18},{19,20},
+                                              {21,22},{23,24},{19,21},{20,22},{18,19},{20,21},{22,23},{0,15},
+                                              {1,16},{2,17},{3,18},{4,19},{5,20},{6,21},{7,22},{8,23},{9,24},
+                                              {10,25},{11,26},{8,15},{9,16},{10,17},{11,18},{12,19},{13,20},
+                                              {14,21},{4,8},{5,9},{6,10},{7,11},{12,15},{13,16},{14,17},
+                                              {18,22},{19,23},{20,24},{21,25},{2,4},{3,5},{6,8},{7,9},{10,12},
+                                              {11,13},{14,15},{16,18},{17,19},{20,22},{21,23},{24,26},{1,2},
+                                              {3,4},{5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18},{19,20},
+                                              {21,22},{23,24},{25,26}};
+                constexpr comparator n28[] = {{0,13},{1,12},{2,15},{3,14},{4,8},{5,6},{7,11},{9,10},{0,5},
+                                              {1,7},{2,9},{3,4},{6,13},{8,14},{10,15},{11,12},{0,1},{2,3},
+                                              {4,5},{6,8},{7,9},{10,11},{12,13},{14,15},{0,2},{1,3},{4,10},
+                                              {5,11},{6,7},{8,9},{12,14},{13,15},{1,2},{3,12},{4,6},{5,7},
+                                              {8,10},{9,11},{13,14},{1,4},{2,6},{5,8},{7,10},{9,13},{11,14},
+                                              {2,4},{3,6},{9,12},{11,13},{3,5},{6,8},{7,9},{10,12},{3,4},{5,6},
+                                              {7,8},{9,10},{11,12},{6,7},{8,9},{16,24},{17,23},{18,22},{19,27},
+                                              {20,26},{21,25},{16,17},{18,21},{19,20},{22,25},{23,24},{26,27},
+                                              {16,18},{17,22},{21,26},{25,27},{16,19},{17,18},{20,22},{21,23},
+                                              {24,27},{25,26},{17,20},{19,21},{22,24},{23,26},{17,19},{18,21},
+                                              {22,25},{24,26},{18,19},{20,21},{22,23},{24,25},{20,22},{21,23},
+                                              {19,20},{21,22},{23,24},{0,16},{1,17},{2,18},{3,19},{4,20},
+                                              {5,21},{6,22},{7,23},{8,24},{9,25},{10,26},{11,27},{8,16},{9,17},
+                                              {10,18},{11,19},{12,20},{13,21},{14,22},{15,23},{4,8},{5,9},
+                                              {6,10},{7,11},{12,16},{13,17},{14,18},{15,19},{20,24},{21,25},
+                                              {22,26},{23,27},{2,4},{3,5},{6,8},{7,9},{10,12},{11,13},{14,16},
+                                              {15,17},{18,20},{19,21},{22,24},{23,25},{1,2},{3,4},{5,6},{7,8},
+                                              {9,10},{11,12},{13,14},{15,16},{17,18},{19,20},{21,22},{23,24},
+                                              {25,26}};
+                constexpr comparator n29[] = {{0,13},{1,12},{2,6},{3,4},{5,9},{7,8},{3,11},{5,10},{0,7},{1,2},
+                                              {6,12},{8,13},{3,5},{0,1},{2,11},{4,6},{7,10},{8,9},{12,13},
+                                              {0,3},{1,5},{2,8},{9,11},{4,7},{6,10},{1,3},{5,12},{2,4},{7,9},
+                                              {6,8},{10,11},{1,2},{3,4},{6,7},{8,9},{10,13},{2,3},{4,5},
+                                              {10,12},{11,13},{4,6},{5,7},{8,10},{9,12},{3,4},{5,6},{7,8},
+                                              {9,10},{11,12},{6,7},{8,9},{14,27},{15,26},{17,28},{18,22},
+                                              {19,20},{21,25},{23,24},{14,19},{15,21},{16,23},{17,18},{20,27},
+                                              {22,28},{25,26},{14,15},{16,17},{18,19},{20,22},{21,23},{24,25},
+                                              {26,27},{14,16},{15,17},{18,24},{19,25},{20,21},{22,23},{26,28},
+                                              {15,16},{17,26},{18,20},{19,21},{22,24},{23,25},{27,28},{15,18},
+                                              {16,20},{19,22},{21,24},{23,27},{25,28},{16,18},{17,20},{23,26},
+                                              {25,27},{17,19},{20,22},{21,23},{24,26},{17,18},{19,20},{21,22},
+                                              {23,24},{25,26},{20,21},{22,23},{0,14},{1,15},{2,16},{3,17},
+                                              {4,18},{5,19},{6,20},{7,21},{8,22},{9,23},{10,24},{11,25},
+                                              {12,26},{13,27},{8,14},{9,15},{10,16},{11,17},{12,18},{13,19},
+                                              {20,28},{4,8},{5,9},{6,10},{7,11},{12,14},{13,15},{16,20},
+                                              {17,21},{18,22},{19,23},{24,28},{2,4},{3,5},{6,8},{7,9},{10,12},
+                                              {11,13},{14,16},{15,17},{18,20},{19,21},{22,24},{23,25},{26,28},
+                                              {1,2},{3,4},{5,6},{7,8},{9,10},{11,12},{13,14},{15,16},{17,18},
+                                              {19,20},{21,22},{23,24},{25,26},{27,28}};
+                constexpr comparator n30[] = {{0,11},{1,14},{2,13},{3,7},{4,5},{6,10},{8,9},{4,12},{0,6},{1,8},
+                                              {2,3},{7,13},{9,14},{10,11},{0,4},{1,2},{3,12},{5,7},{6,8},
+                                              {9,10},{13,14},{0,1},{2,4},{3,9},{10,12},{5,6},{7,8},{11,13},
+                                              {1,2},{4,11},{3,5},{6,10},{7,9},{8,12},{13,14},{1,3},{2,5},{6,7},
+                                              {9,10},{8,13},{12,14},{2,3},{4,5},{8,11},{12,13},{4,6},{5,7},
+                                              {8,9},{10,11},{3,4},{5,6},{7,8},{9,10},{11,12},{6,7},{8,9},
+                                              {15,28},{16,27},{18,29},{19,23},{20,21},{22,26},{24,25},{15,20},
+                                              {16,22},{17,24},{18,19},{21,28},{23,29},{26,27},{15,16},{17,18},
+                                              {19,20},{21,23},{22,24},{25,26},{27,28},{15,17},{16,18},{19,25},
+                                              {20,26},{21,22},{23,24},{27,29},{16,17},{18,27},{19,21},{20,22},
+                                              {23,25},{24,26},{28,29},{16,19},{17,21},{20,23},{22,25},{24,28},
+                                              {26,29},{17,19},{18,21},{24,27},{26,28},{18,20},{21,23},{22,24},
+                                              {25,27},{18,19},{20,21},{22,23},{24,25},{26,27},{21,22},{23,24},
+                                              {0,15},{1,16},{2,17},{3,18},{4,19},{5,20},{6,21},{7,22},{8,23},
+                                              {9,24},{10,25},{11,26},{12,27},{13,28},{14,29},{8,15},{9,16},
+                                              {10,17},{11,18},{12,19},{13,20},{14,21},{4,8},{5,9},{6,10},
+                                              {7,11},{12,15},{13,16},{14,17},{18,22},{19,23},{20,24},{21,25},
+                                              {2,4},{3,5},{6,8},{7,9},{10,12},{11,13},{14,15},{16,18},{17,19},
+                                              {20,22},{21,23},{24,26},{25,27},{1,2},{3,4},{5,6},{7,8},{9,10},
+                                              {11,12},{13,14},{15,16},{17,18},{19,20},{21,22},{23,24},{25,26},
+                                              {27,28}};
+                constexpr comparator n31[] = {{0,11},{1,14},{2,13},{3,7},{4,5},{6,10},{8,9},{4,12},{0,6},{1,8},
+                                              {2,3},{7,13},{9,14},{10,11},{0,4},{1,2},{3,12},{5,7},{6,8},
+                                              {9,10},{13,14},{0,1},{2,4},{3,9},{10,12},{5,6},{7,8},{11,13},
+                                              {1,2},{4,11},{3,5},{6,10},{7,9},{8,12},{13,14},{1,3},{2,5},{6,7},
+                                              {9,10},{8,13},{12,14},{2,3},{4,5},{8,11},{12,13},{4,6},{5,7},
+                                              {8,9},{10,11},{3,4},{5,6},{7,8},{9,10},{11,12},{6,7},{8,9},
+                                              {15,28},{16,27},{17,30},{18,29},{19,23},{20,21},{22,26},{24,25},
+                                              {15,20},{16,22},{17,24},{18,19},{21,28},{23,29},{25,30},{26,27},
+                                              {15,16},{17,18},{19,20},{21,23},{22,24},{25,26},{27,28},{29,30},
+                                              {15,17},{16,18},{19,25},{20,26},{21,22},{23,24},{27,29},{28,30},
+                                              {16,17},{18,27},{19,21},{20,22},{23,25},{24,26},{28,29},{16,19},
+                                              {17,21},{20,23},{22,25},{24,28},{26,29},{17,19},{18,21},{24,27},
+                                              {26,28},{18,20},{21,23},{22,24},{25,27},{18,19},{20,21},{22,23},
+                                              {24,25},{26,27},{21,22},{23,24},{0,15},{1,16},{2,17},{3,18},
+                                              {4,19},{5,20},{6,21},{7,22},{8,23},{9,24},{10,25},{11,26},
+                                              {12,27},{13,28},{14,29},{8,15},{9,16},{10,17},{11,18},{12,19},
+                                              {13,20},{14,21},{22,30},{4,8},{5,9},{6,10},{7,11},{12,15},
+                                              {13,16},{14,17},{18,22},{19,23},{20,24},{21,25},{26,30},{2,4},
+                                              {3,5},{6,8},{7,9},{10,12},{11,13},{14,15},{16,18},{17,19},
+                                              {20,22},{21,23},{24,26},{25,27},{28,30},{1,2},{3,4},{5,6},{7,8},
+                                              {9,10},{11,12},{13,14},{15,16},{17,18},{19,20},{21,22},{23,24},
+                                              {25,26},{27,28},{29,30}};
+                constexpr comparator n15[] = {{0,11},{1,14},{2,13},{3,7},{4,5},{6,10},{8,9},{4,12},{0,6},{1,8},
+                                              {2,3},{7,13},{9,14},{10,11},{0,4},{1,2},{3,12},{5,7},{6,8},
+                                              {9,10},{13,14},{0,1},{2,4},{3,9},{10,12},{5,6},{7,8},{11,13},
+                                              {1,2},{4,11},{3,5},{6,10},{7,9},{8,12},{13,14},{1,3},{2,5},{6,7},
+                                              {9,10},{8,13},{12,14},{2,3},{4,5},{8,11},{12,13},{4,6},{5,7},
+                                              {8,9},{10,11},{3,4},{5,6},{7,8},{9,10},{11,12},{6,7},{8,9}};
+                constexpr comparator n16[] = {{0,13},{1,12},{2,15},{3,14},{4,8},{5,6},{7,11},{9,10},
+                                              {0,5},{1,7},{2,9},{3,4},{6,13},{8,14},{10,15},{11,12},
+                                              {0,1},{2,3},{4,5},{6,8},{7,9},{10,11},{12,13},{14,15},
+                                              {0,2},{1,3},{4,10},{5,11},{6,7},{8,9},{12,14},{13,15},
+                                              {1,2},{3,12},{4,6},{5,7},{8,10},{9,11},{13,14},
+                                              {1,4},{2,6},{5,8},{7,10},{9,13},{11,14},
+                                              {2,4},{3,6},{9,12},{11,13},
+                                              {3,5},{6,8},{7,9},{10,12},
+                                              {3,4},{5,6},{7,8},{9,10},{11,12},
+                                              {6,7},{8,9}};
+                switch (n){
+                    case 3: return from(n3, std::size(n3));
+                    case 4: return from(n4, std::size(n4));
+                    case 5: return from(n5, std::size(n5));
+                    case 6: return from(n6, std::size(n6));
+                    case 7: return from(n7, std::size(n7));
+                    case 8: return from(n8, std::size(n8));
+                    case 9: return from(n9, std::size(n9));
+                    case 10: return from(n10, std::size(n10));
+                    case 11: return from(n11, std::size(n11));
+                    case 12: return from(n12, std::size(n12));
+                    case 13: return from(n13, std::size(n13));
+                    case 14: return from(n14, std::size(n14));
+                    case 15: return from(n15, std::size(n15));
+                    case 16: return from(n16, std::size(n16));
+                    case 17: return from(n17, std::size(n17));
+                    case 18: return from(n18, std::size(n18));
+                    case 19: return from(n19, std::size(n19));
+                    case 20: return from(n20, std::size(n20));
+                    case 21: return from(n21, std::size(n21));
+                    case 22: return from(n22, std::size(n22));
+                    case 23: return from(n23, std::size(n23));
+                    case 24: return from(n24, std::size(n24));
+                    case 25: return from(n25, std::size(n25));
+                    case 26: return from(n26, std::size(n26));
+                    case 27: return from(n27, std::size(n27));
+                    case 28: return from(n28, std::size(n28));
+                    case 29: return from(n29, std::size(n29));
+                    case 30: return from(n30, std::size(n30));
+                    case 31: return from(n31, std::size(n31));
+                }
+                builder best = bose_nelson::build(n);
+                builder bt = batcher::build(n);
+                if (bt.size < best.size)
+                    best = bt;
+                if (n > 2){
+                    std::size_t p = 1;
+                    while (2 * p < n)
+                        p <<= 1;
+                    builder joined;
+                    joined.append(build(p), 0);
+                    joined.append(build(n - p), p);
+                    batcher::merge(joined, n, p);
+                    if (joined.size < best.size)
+                        best = joined;
+                }
+                return best;
+            }
+        };
+
+        template<std::size_t N, typename Algorithm>
+        struct layout{
+            static_assert(N <= max_inputs, "sorting networks are meant for small fixed N");
+
+            static constexpr builder full = Algorithm::build(N);
+            static constexpr std::size_t size = full.size;
+
+            static constexpr std::array<comparator, size> make(){
+                std::array<comparator, size> out{};
+                for (std::size_t k = 0; k < size; ++k){
+                    out[k] = full.list[k];
+                }
+                return out;
+            }
+
+            static constexpr std::array<comparator, size> comparators = make();
+        };
+
+        // Arithmetic types get a branch free select that compiles to cmov/min/max.
+        // Anything else, SortyObj included, compares once and swaps only when out of
+        // order, so no temporaries are copied for comparators that leave data in place.
+        template<typename RandomIt>
+        inline void compare_exchange(RandomIt a, RandomIt b){
+            using value_type = typename std::iterator_traits<RandomIt>::value_type;
+            if constexpr (std::is_arithmetic_v<value_type>){
+                value_type x = *a;
+                value_type y = *b;
+                bool greater = y < x;
+                *a = greater ? y : x;
+                *b = greater ? x : y;
+            }
+            else{
+                if (*b < *a)
+                    std::iter_swap(a, b);
+            }
+        }
+
+        template<std::size_t N, typename Algorithm, typename RandomIt, std::size_t... K>
+        inline void apply([[maybe_unused]] RandomIt first, std::index_sequence<K...>){
+            (compare_exchange(first + layout<N, Algorithm>::comparators[K].i,
+                              first + layout<N, Algorithm>::comparators[K].j), ...);
+        }
+    }
+
+    // Number of compare-exchange steps of the network static_sort<N, Algorithm> unrolls.
+    template<std::size_t N, typename Algorithm = network::best_known>
+    constexpr std::size_t network_size(){
+        return network::layout<N, Algorithm>::size;
+    }
+
+    // Sorts [first, first + N) with a sorting network fully unrolled at compile time.
+    template<std::size_t N, typename Algorithm = network::best_known, typename RandomIt>
+    void static_sort(RandomIt first){
+        network::apply<N, Algorithm>(first, std::make_index_sequence<network_size<N, Algorithm>()>{});
+    }
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "sorty.hpp"
+#include "networks.hpp"
 
 template<typename RandomIt>
 void insertion_sort(RandomIt begin, RandomIt end) {
@@ -159,4 +160,39 @@ void radix_sort(RandomIt begin, RandomIt end) {
             bucket.clear();
         }
     }
-}
\ No newline at end of file
+}
+
+template<std::size_t N, typename RandomIt>
+void network_blocks(RandomIt begin, RandomIt end) {
+    // Sort every full block of N with the unrolled network, the tail with insertion sort
+    auto n = std::distance(begin, end);
+    auto block = begin;
+    for (; std::distance(block, end) >= static_cast<decltype(n)>(N); block += N) {
+        sal::static_sort<N>(block);
+    }
+    insertion_sort(block, end);
+}
+
+template<std::size_t N, typename RandomIt>
+void insertion_blocks(RandomIt begin, RandomIt end) {
+    // Same blocks as network_blocks, each one sorted by insertion sort
+    auto n = std::distance(begin, end);
+    for (auto block = begin; block != end; ) {
+        auto next = (std::distance(block, end) >= static_cast<decltype(n)>(N)) ? block + N : end;
+        insertion_sort(block, next);
+        block = next;
+    }
+}
+
+template<std::size_t N, typename RandomIt>
+void network_sort(RandomIt begin, RandomIt end) {
+    network_blocks<N>(begin, end);
+
+    // Merge the sorted blocks bottom-up
+    auto n = std::distance(begin, end);
+    for (decltype(n) width = N; width < n; width *= 2) {
+        for (decltype(n) left = 0; left + width < n; left += 2 * width) {
+            std::inplace_merge(begin + left, begin + left + width, begin + std::min(left + 2 * width, n));
+        }
+    }
+}